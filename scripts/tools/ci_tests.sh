@@ -297,6 +297,70 @@ run_bsd_cross_compile() {
     echo "BSD cross-compilation successfully linked executable."
 }
 
+run_debug_compression_tests() {
+    local MY_WORK_DIR="$WORK_DIR/debug_compression"
+    mkdir -p "$MY_WORK_DIR"
+
+    echo "--- Running Debug Section Compression Check ---"
+    if [[ "$OS_MODE" != "linux" ]] || ! command -v readelf &> /dev/null; then
+        echo "Skipping debug section compression check (needs ELF objects and readelf)."
+        return
+    fi
+
+    cd "$ROOT_DIR/resources"
+    run_c3c compile-only -g --single-module=yes --compress-debug-sections=zlib examples/factorial_macro.c3
+
+    # readelf shows SHF_COMPRESSED as a 'C' in the flags column.
+    local found=0
+    for obj in "$MY_WORK_DIR"/*.o; do
+        [ -e "$obj" ] || continue
+        if readelf -S -W "$obj" | grep -E '\] \.debug_info ' | grep -qE ' [A-Z]*C[A-Z]* +[0-9]+ +[0-9]+ +[0-9]+$'; then
+            found=1
+        else
+            echo "::error::.debug_info in $obj is not compressed."
+            exit 1
+        fi
+    done
+    if [ $found -eq 0 ]; then
+        echo "::error::No objects were emitted."
+        exit 1
+    fi
+    echo "Debug sections are compressed."
+}
+
+run_split_module_tests() {
+    local MY_WORK_DIR="$WORK_DIR/split_module"
+    mkdir -p "$MY_WORK_DIR"
+
+    echo "--- Running Split Module Check ---"
+    cd "$MY_WORK_DIR"
+
+    # The parts of a split module must link back together.
+    run_c3c compile-run --single-module=yes --threads 2 "$ROOT_DIR/resources/examples/factorial_macro.c3"
+
+    if [[ "$OS_MODE" == "windows" ]] || ! command -v ar &> /dev/null; then
+        echo "Skipping split object count check (needs ar)."
+        return
+    fi
+
+    # A static library is a single module, so with two threads it gets one object per part.
+    run_c3c static-lib --threads 2 "$ROOT_DIR/resources/examples/factorial_macro.c3" -o libsplit
+    local count=$(ar t libsplit.a | grep -v SYMDEF | wc -l)
+    if [ "$count" -lt 2 ]; then
+        echo "::error::Expected the module to be split, got $count object(s)."
+        exit 1
+    fi
+
+    # Emitting IR keeps the module whole.
+    run_c3c static-lib --threads 2 --emit-llvm "$ROOT_DIR/resources/examples/factorial_macro.c3" -o libwhole
+    count=$(ar t libwhole.a | grep -v SYMDEF | wc -l)
+    if [ "$count" -ne 1 ]; then
+        echo "::error::Expected no split when emitting IR, got $count object(s)."
+        exit 1
+    fi
+    echo "Single module splitting works."
+}
+
 run_http_server_tests() {
     local MY_WORK_DIR="$WORK_DIR/http"
     mkdir -p "$MY_WORK_DIR"
@@ -426,6 +490,8 @@ run_parallel testproject run_testproject
 run_parallel wasm run_wasm_compile
 run_parallel bsd_cross run_bsd_cross_compile
 run_parallel http run_http_server_tests
+run_parallel debug_compression run_debug_compression_tests
+run_parallel split_module run_split_module_tests
 
 # Wait for background tasks
 exit_code=0
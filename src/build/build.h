@@ -242,6 +242,8 @@ typedef struct BuildOptions_
 	DiagnosticsSeverity severity[DIAG_END_SENTINEL];
 	OptimizationSetting optsetting;
 	DebugInfo debug_info_override;
+	SplitDebug split_debug;
+	CompressDebug compress_debug;
 	ShowBacktrace show_backtrace;
 	ArchOsTarget arch_os_target_override;
 	SafetyLevel safety_level;
@@ -443,6 +445,8 @@ typedef struct
 	ShowBacktrace show_backtrace;
 	StripUnused strip_unused;
 	DebugInfo debug_info;
+	SplitDebug split_debug;
+	CompressDebug compress_debug;
 	MergeFunctions merge_functions;
 	UnrollLoops unroll_loops;
 	AutoVectorization loop_vectorization;
@@ -546,6 +550,8 @@ static BuildTarget default_build_target = {
 		.optsize = SIZE_OPTIMIZATION_NOT_SET,
 		.arch_os_target = ARCH_OS_TARGET_DEFAULT,
 		.debug_info = DEBUG_INFO_NOT_SET,
+		.split_debug = SPLIT_DEBUG_NOT_SET,
+		.compress_debug = COMPRESS_DEBUG_NOT_SET,
 		.show_backtrace = SHOW_BACKTRACE_NOT_SET,
 		.use_stdlib = USE_STDLIB_NOT_SET,
 		.link_libc = LINK_LIBC_NOT_SET,
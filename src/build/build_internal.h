@@ -91,6 +91,12 @@ static const char *win_debug_type[2] = {
 	[WIN_DEBUG_DWARF] = "dwarf",
 };
 
+static const char *compress_debug_sections[3] = {
+	[COMPRESS_DEBUG_NONE] = "none",
+	[COMPRESS_DEBUG_ZLIB] = "zlib",
+	[COMPRESS_DEBUG_ZSTD] = "zstd",
+};
+
 static const char *fp_math[3] = {
 	[FP_STRICT] = "strict",
 	[FP_RELAXED] = "relaxed",
@@ -151,6 +151,11 @@ static void usage(bool full)
 	print_opt("-g", "Emit debug info.");
 	print_opt("-g0", "Emit no debug info.");
 	if (full)
+	{
+		print_opt("--split-debug=<yes|no>", "Place the bulk of the debug info in separate .dwo files (ELF only).");
+		print_opt("--compress-debug-sections=<option>", "Compress debug sections: none, zlib, zstd (ELF only).");
+	}
+	if (full)
 	{
 		PRINTF("");
 		print_opt("--ansi=<yes|no>", "Set colour output using ansi on/off, default is to try to detect it.");
@@ -1218,6 +1223,16 @@ static void parse_option(BuildOptions *options)
 				options->strip_unused = parse_opt_select(StripUnused, argopt, on_off);
 				return;
 			}
+			if ((argopt = match_argopt("split-debug")))
+			{
+				options->split_debug = parse_opt_select(SplitDebug, argopt, on_off);
+				return;
+			}
+			if ((argopt = match_argopt("compress-debug-sections")))
+			{
+				options->compress_debug = parse_opt_select(CompressDebug, argopt, compress_debug_sections);
+				return;
+			}
 			if ((argopt = match_argopt("emit-stdlib")))
 			{
 				options->emit_stdlib = parse_opt_select(EmitStdlib, argopt, on_off);
@@ -1766,6 +1781,8 @@ BuildOptions parse_arguments(int argc, const char *argv[])
 		.emit_llvm = false,
 		.optsetting = OPT_SETTING_NOT_SET,
 		.debug_info_override = DEBUG_INFO_NOT_SET,
+		.split_debug = SPLIT_DEBUG_NOT_SET,
+		.compress_debug = COMPRESS_DEBUG_NOT_SET,
 		.test_log_level = TESTLOGLEVEL_NOT_SET,
 		.safety_level = SAFETY_NOT_SET,
 		.panic_level = PANIC_NOT_SET,
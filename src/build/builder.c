@@ -490,6 +490,8 @@ static void update_build_target_from_options(BuildTarget *target, BuildOptions *
 	set_if_updated(target->strip_unused, options->strip_unused);
 	set_if_updated(target->memory_environment, options->memory_environment);
 	set_if_updated(target->debug_info, options->debug_info_override);
+	set_if_updated(target->split_debug, options->split_debug);
+	set_if_updated(target->compress_debug, options->compress_debug);
 	set_if_updated(target->show_backtrace, options->show_backtrace);
 	set_if_updated(target->arch_os_target, options->arch_os_target_override);
 	set_if_updated(target->reloc_model, options->reloc_model);
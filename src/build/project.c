@@ -17,6 +17,7 @@ const char *project_default_keys[][2] = {
 		{"c-sources", "Set the C sources to be compiled."},
 		{"cc", "Set C compiler (defaults to 'cc')."},
 		{"cflags", "C compiler flags."},
+		{"compress-debug-sections", "Compress debug sections: none, zlib, zstd (ELF only)."},
 		{"cpu", "CPU name, used for optimizations in the compiler backend."},
 		{"cpu-flags", "Set the cpu flags to add or remove with the format '+avx,-sse'."},
 		{"debug-info", "Debug level: none, line-tables, full."},
@@ -62,6 +63,7 @@ const char *project_default_keys[][2] = {
 		{"slp-vectorize", "Force enable/disable SLP auto-vectorization."},
 		{"soft-float", "Output soft-float functions."},
 		{"sources", "Paths to project sources for all targets."},
+		{"split-debug", "Place the bulk of the debug info in separate .dwo files (ELF only)."},
 		{"strip-unused", "Strip unused code and globals from the output. (default: true)"},
 		{"symtab", "Sets the preferred symtab size."},
 		{"target", "Compile for a particular architecture + OS target."},
@@ -99,6 +101,7 @@ const char* project_target_keys[][2] = {
 		{"cc", "Set C compiler (defaults to 'cc')."},
 		{"cflags", "Additional C compiler flags for the target."},
 		{"cflags-override", "C compiler flags for the target, overriding global settings."},
+		{"compress-debug-sections", "Compress debug sections: none, zlib, zstd (ELF only)."},
 		{"cpu", "CPU name, used for optimizations in the compiler backend."},
 		{"cpu-flags", "Additional cpu flags to add or remove with the format '+avx,-sse'."},
 		{"cpu-flags-override", "Additional cpu flags to add or remove with the format '+avx,-sse', overriding global settings."},
@@ -153,6 +156,7 @@ const char* project_target_keys[][2] = {
 		{"soft-float", "Output soft-float functions."},
 		{"sources", "Additional paths to project sources for the target."},
 		{"sources-override", "Paths to project sources for this target, overriding global settings."},
+		{"split-debug", "Place the bulk of the debug info in separate .dwo files (ELF only)."},
 		{"strip-unused", "Strip unused code and globals from the output. (default: true)"},
 		{"symtab", "Sets the preferred symtab size."},
 		{"target", "Compile for a particular architecture + OS target."},
@@ -321,6 +325,13 @@ static void load_into_build_target(BuildParseContext context, JSONObject *json,
 	DebugInfo info = GET_SETTING(DebugInfo, "debug-info", debug_infos, "one of 'full' 'line-table' or 'none'.");
 	if (info > -1) target->debug_info = info;
 
+	// split-debug
+	target->split_debug = (SplitDebug) get_valid_bool(context, json, "split-debug", target->split_debug);
+
+	// compress-debug-sections
+	CompressDebug compress = GET_SETTING(CompressDebug, "compress-debug-sections", compress_debug_sections, "'none', 'zlib' or 'zstd'.");
+	if (compress != COMPRESS_DEBUG_NOT_SET) target->compress_debug = compress;
+
 	// Optimization Level
 	target->optlevel = GET_SETTING(OptimizationLevel, "optlevel", optlevels, "`none`, `less`, `more`, `max`.");
 
@@ -227,6 +227,8 @@ static void view_target(BuildParseContext context, JSONObject *target, bool verb
 	TARGET_VIEW_STRING("C compiler flags (override)", "cflags-override");
 	TARGET_VIEW_STRING("CPU name", "cpu");
 	TARGET_VIEW_SETTING("Debug level", "debug-info", debug_levels);
+	TARGET_VIEW_BOOL("Split debug info", "split-debug");
+	TARGET_VIEW_SETTING("Debug section compression", "compress-debug-sections", compress_debug_sections);
 	TARGET_VIEW_STRING_ARRAY("Additional scripts to run", "exec", ", ");
 	TARGET_VIEW_STRING_ARRAY("Scripts to run (override)", "exec", ", ");
 	TARGET_VIEW_STRING_ARRAY("Enabled features", "features", ", ");
@@ -560,6 +562,8 @@ void view_project(BuildOptions *build_options)
 	VIEW_STRING("Android NDK directory", "android-ndk");
 	VIEW_STRING("CPU name", "cpu");
 	VIEW_SETTING("Debug level", "debug-info", debug_levels);
+	VIEW_BOOL("Split debug info", "split-debug");
+	VIEW_SETTING("Debug section compression", "compress-debug-sections", compress_debug_sections);
 	VIEW_STRING_ARRAY("Scripts to run", "exec", ", ");
 	VIEW_STRING_ARRAY("Enabled features", "features", ", ");
 	VIEW_SETTING("Floating point behaviour", "fp-math", fp_math);
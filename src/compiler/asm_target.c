@@ -690,6 +690,8 @@ static void init_asm_x86(PlatformTarget* target)
 	reg_instr(target, "movslq", "w:r64/mem, r32/mem");
 	reg_instr(target, "movzlq", "w:r64/mem, r32/mem");
 	reg_instr(target, "movq", "w:r64/mem, r64/mem/immi32/imm64"); // Seg
+	reg_instr(target, "movdqa", "w:v128/mem, v128/mem");
+	reg_instr(target, "movdqu", "w:v128/mem, v128/mem");
 	//reg_instr("mov", "wAARG_SEG | AARG_W, AARG_R16 | AARG_R64, 0); // Seg
 	/*
 	reg_instr("movabsb", AARG_R8 | AARG_IMM64, AARG_R8 | AARG_IMM64, 0); // Missing segment
@@ -792,6 +794,16 @@ static void init_asm_x86(PlatformTarget* target)
 	reg_instr_clob(target, "adcx", cc_flag_mask, "rw:r32/r64, r32/r64/mem");
 	reg_instr_clob(target, "adox", cc_flag_mask, "rw:r32/r64, r32/r64/mem");
 
+	// SSE2 logic
+	reg_instr(target, "pand", "rw:v128, v128/mem");
+	reg_instr(target, "pxor", "rw:v128, v128/mem");
+
+	// SSE2 integer and SSSE3 shuffles
+	reg_instr(target, "paddd", "rw:v128, v128/mem");
+	reg_instr(target, "pshufd", "w:v128, v128/mem, imm8");
+	reg_instr(target, "pshufb", "rw:v128, v128/mem");
+	reg_instr(target, "palignr", "rw:v128, v128/mem, imm8");
+
 	// PCLMULQDQ
 	reg_instr(target, "pclmulqdq", "rw:v128, v128/mem, imm8");
 	reg_instr(target, "vpclmulqdq", "w:v128/v256/v512, v128/v256/v512, v128/v256/v512/mem, imm8");
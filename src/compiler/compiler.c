@@ -83,6 +83,7 @@ void compiler_init(BuildOptions *build_options)
 
 	htable_init(&compiler.context.features, 1024);
 	htable_init(&compiler.context.compiler_defines, 16 * 1024);
+	htable_init(&compiler.context.macro_folds, 4 * 1024);
 	methodtable_init(&compiler.context.method_extensions, 16 * 1024);
 	compiler.context.module_list = NULL;
 	compiler.context.method_extension_list = NULL;
@@ -942,6 +943,7 @@ void clean_obj_files(void)
 	file_delete_all_files_in_dir_with_suffix(compiler.build.asm_file_dir, ".s");
 	file_delete_all_files_in_dir_with_suffix(compiler.build.object_file_dir, ".obj");
 	file_delete_all_files_in_dir_with_suffix(compiler.build.object_file_dir, ".o");
+	file_delete_all_files_in_dir_with_suffix(compiler.build.object_file_dir, ".dwo");
 }
 void compile_clean(BuildOptions *options)
 {
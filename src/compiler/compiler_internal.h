@@ -405,6 +405,7 @@ typedef struct
 	const char **links;
 	const char *section;
 	const char *wasm_module;
+	const char **target_clones;
 	SourceLocId overload;
 } ResolvedAttrData;
 
@@ -2018,6 +2019,13 @@ typedef struct
 	bool link_math;
 } Linking;
 
+typedef struct
+{
+	Expr *subscript;
+	Decl *index;
+	Decl *collection;
+} RangeProof;
+
 typedef struct
 {
 	bool should_print_environment;
@@ -2038,6 +2046,9 @@ typedef struct
 	Decl ***locals_list;
 	HTable compiler_defines;
 	HTable features;
+	HTable macro_folds;
+	RangeProof *range_proofs;
+	unsigned call_site_builtins_used;
 	Module std_module;
 	MethodTable method_extensions;
 	Type **types_with_failed_methods;
@@ -2200,6 +2211,16 @@ INLINE bool strip_unused(void)
 	return compiler.build.strip_unused != STRIP_UNUSED_OFF;
 }
 
+INLINE bool split_debug_enabled(void)
+{
+	return compiler.build.split_debug == SPLIT_DEBUG_ON && compiler.build.debug_info != DEBUG_INFO_NONE;
+}
+
+INLINE bool compress_debug_enabled(void)
+{
+	return compiler.build.compress_debug > COMPRESS_DEBUG_NONE && compiler.build.debug_info != DEBUG_INFO_NONE;
+}
+
 INLINE bool no_stdlib(void)
 {
 	return compiler.build.use_stdlib == USE_STDLIB_OFF;
@@ -2335,6 +2356,7 @@ UNUSED bool i128_get_bit(const Int128 *op, int bit);
 
 
 void copy_begin(void);
+void copy_begin_macro_resume(Decl **original_params, Decl **params);
 void copy_end(void);
 Expr *copy_expr_single(Expr *source_expr);
 Expr **copy_exprlist_macro(Expr **source_expr_list);
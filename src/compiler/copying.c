@@ -835,6 +835,19 @@ void copy_begin(void)
 	copy_struct.single_static = false;
 }
 
+/**
+ * Start copying the rest of a macro whose parameters were copied in an earlier
+ * session, so that references to the original parameters resolve to those copies.
+ */
+void copy_begin_macro_resume(Decl **original_params, Decl **params)
+{
+	copy_begin();
+	FOREACH_IDX(i, Decl *, param, original_params)
+	{
+		if (param) copy_reg_ref(&copy_struct, param, params[i]);
+	}
+}
+
 void copy_end(void)
 {
 	ASSERT(copy_struct.copy_in_use);
@@ -882,12 +895,15 @@ static ResolvedAttrData *copy_attrs_resolved(CopyStruct *c, ResolvedAttrData *da
 	ResolvedAttrData *copy = MALLOCS(ResolvedAttrData);
 	const char **new_links = NULL;
 	FOREACH(const char *, link, data->links) vec_add(new_links, link);
+	const char **new_clones = NULL;
+	FOREACH(const char *, clone, data->target_clones) vec_add(new_clones, clone);
 	*copy = (ResolvedAttrData) {
 			.tags = copy_attributes(c, data->tags),
 			.deprecated = data->deprecated,
 			.links = new_links,
 			.section = data->section,
-			.wasm_module = data->wasm_module
+			.wasm_module = data->wasm_module,
+			.target_clones = new_clones
 	};
 	return copy;
 }
@@ -148,6 +148,21 @@ typedef enum
 	STRIP_UNUSED_ON = 1
 } StripUnused;
 
+typedef enum
+{
+	SPLIT_DEBUG_NOT_SET = -1,
+	SPLIT_DEBUG_OFF = 0,
+	SPLIT_DEBUG_ON = 1
+} SplitDebug;
+
+typedef enum
+{
+	COMPRESS_DEBUG_NOT_SET = -1,
+	COMPRESS_DEBUG_NONE = 0,
+	COMPRESS_DEBUG_ZLIB = 1,
+	COMPRESS_DEBUG_ZSTD = 2
+} CompressDebug;
+
 typedef enum
 {
 	LINK_LIBC_NOT_SET = -1,
@@ -668,6 +683,7 @@ typedef enum
 	ATTRIBUTE_SIMD,
 	ATTRIBUTE_SECTION,
 	ATTRIBUTE_TAG,
+	ATTRIBUTE_TARGET_CLONES,
 	ATTRIBUTE_TEST,
 	ATTRIBUTE_UNUSED,
 	ATTRIBUTE_USED,
@@ -30,6 +30,11 @@ static inline bool is_pie(RelocModel reloc)
 	return reloc == RELOC_BIG_PIE || reloc == RELOC_SMALL_PIE;
 }
 
+static const char *compress_debug_section_name(void)
+{
+	return compiler.build.compress_debug == COMPRESS_DEBUG_ZSTD ? "zstd" : "zlib";
+}
+
 static const char *ld_target(ArchType arch_type)
 {
 	switch (arch_type)
@@ -932,6 +937,7 @@ static bool linker_setup(const char ***args_ref, const char **files_to_link, uns
 			break;
 		case LINKER_LD:
 			if (is_dylib) add_plain_arg("-shared");
+			if (compress_debug_enabled()) add_plain_arg(str_printf("--compress-debug-sections=%s", compress_debug_section_name()));
 			break;
 		case LINKER_LINK_EXE:
 			add_concat_quote_arg("/OUT:", output_file);
@@ -945,6 +951,10 @@ static bool linker_setup(const char ***args_ref, const char **files_to_link, uns
 		default:
 			UNREACHABLE
 	}
+	if (linker_type == LINKER_CC && compress_debug_enabled())
+	{
+		add_plain_arg(str_printf("-Wl,--compress-debug-sections=%s", compress_debug_section_name()));
+	}
 	const char *lib_path_opt = use_win ? "/LIBPATH:" : "-L";
 
 	switch (compiler.platform.os)
@@ -5,6 +5,7 @@
 #include "llvm_codegen_internal.h"
 #include "compiler_tests/benchmark.h"
 #include "c3_llvm.h"
+#include <llvm-c/BitReader.h>
 #include <llvm-c/Comdat.h>
 #include <llvm-c/Linker.h>
 #include <llvm-c/Transforms/PassBuilder.h>
@@ -676,27 +677,18 @@ static void gencontext_verify_ir(GenContext *context)
 	}
 }
 
-static void llvm_emit_file(GenContext *c, const char *filename, LLVMCodeGenFileType llvm_codegen_type, bool clone_module)
+const char *llvm_dwo_filename(const char *object_filename)
 {
-	DEBUG_LOG("Target: %s", compiler.platform.target_triple);
-	LLVMModuleRef module = clone_module ? LLVMCloneModule(c->module) : c->module;
-	LLVMSetTarget(module, compiler.platform.target_triple);
-	char *layout = LLVMCopyStringRepOfTargetData(c->target_data);
-	LLVMSetDataLayout(module, layout);
-	LLVMDisposeMessage(layout);
+	const char *extension = get_object_extension();
+	size_t len = strlen(object_filename);
+	if (str_has_suffix(object_filename, extension)) len -= strlen(extension);
+	return str_printf("%.*s.dwo", (int)len, object_filename);
+}
 
-	char *err = "";
-	FILE *file = NULL;
-	LLVMMemoryBufferRef buffer = NULL;
-	if (LLVMTargetMachineEmitToMemoryBuffer(c->machine, module, llvm_codegen_type, &err, &buffer))
-	{
-		goto ERR;
-	}
-	if (clone_module)
-	{
-		LLVMDisposeModule(module);
-	}
-	file = fopen(filename, "wb");
+static void llvm_write_buffer(const char *filename, LLVMMemoryBufferRef buffer)
+{
+	char *err;
+	FILE *file = fopen(filename, "wb");
 	if (!file)
 	{
 		err = "File could not be opened";
@@ -720,10 +712,43 @@ static void llvm_emit_file(GenContext *c, const char *filename, LLVMCodeGenFileT
 	return;
 ERR:
 	if (file) fclose(file);
-	if (buffer) LLVMDisposeMemoryBuffer(buffer);
+	LLVMDisposeMemoryBuffer(buffer);
 	error_exit("Could not emit '%s': %s", filename, err);
 }
 
+static void llvm_emit_file(GenContext *c, const char *filename, LLVMCodeGenFileType llvm_codegen_type, bool clone_module)
+{
+	DEBUG_LOG("Target: %s", compiler.platform.target_triple);
+	LLVMModuleRef module = clone_module ? LLVMCloneModule(c->module) : c->module;
+	LLVMSetTarget(module, compiler.platform.target_triple);
+	char *layout = LLVMCopyStringRepOfTargetData(c->target_data);
+	LLVMSetDataLayout(module, layout);
+	LLVMDisposeMessage(layout);
+
+	char *err = "";
+	LLVMMemoryBufferRef buffer = NULL;
+	if (llvm_codegen_type == LLVMObjectFile && split_debug_enabled())
+	{
+		// Emit the skeleton object and the .dwo side by side.
+		const char *dwo_filename = llvm_dwo_filename(filename);
+		LLVMMemoryBufferRef dwo_buffer = NULL;
+		if (!llvm_emit_split_dwarf_object(c->machine, module, dwo_filename, &buffer, &dwo_buffer, &err))
+		{
+			error_exit("Could not emit '%s': %s", filename, err);
+		}
+		llvm_write_buffer(dwo_filename, dwo_buffer);
+	}
+	else if (LLVMTargetMachineEmitToMemoryBuffer(c->machine, module, llvm_codegen_type, &err, &buffer))
+	{
+		error_exit("Could not emit '%s': %s", filename, err);
+	}
+	if (clone_module)
+	{
+		LLVMDisposeModule(module);
+	}
+	llvm_write_buffer(filename, buffer);
+}
+
 void gencontext_print_llvm_ir(GenContext *context)
 {
 	char *err = NULL;
@@ -1108,7 +1133,7 @@ const char *llvm_codegen(void *context)
 {
 	GenContext *c = context;
 	if (!compiler_should_output_file(c->base_name)) return NULL;
-	llvm_optimize(c);
+	if (!c->is_optimized) llvm_optimize(c);
 
 	// Serialize the LLVM IR, if requested, also verify the IR in this case
 	if (compiler.build.emit_llvm)
@@ -1566,6 +1591,75 @@ INLINE GenContext *llvm_gen_benchmarks(Module** modules, unsigned module_count,
 	return c;
 }
 
+static bool llvm_should_split_module(void)
+{
+	// Splitting is only useful if the parts can be compiled in parallel.
+	if (compiler.build.build_threads < 2) return false;
+	// IR and asm output are expected as a single file per module.
+	if (compiler.build.emit_llvm || compiler.build.emit_asm || !compiler.build.emit_object_files) return false;
+	if (vec_size(compiler.build.emit_only)) return false;
+	switch (compiler.build.type)
+	{
+		case TARGET_TYPE_EXECUTABLE:
+		case TARGET_TYPE_STATIC_LIB:
+		case TARGET_TYPE_DYNAMIC_LIB:
+		case TARGET_TYPE_TEST:
+		case TARGET_TYPE_BENCHMARK:
+			return true;
+		default:
+			// Object file output keeps one object per module.
+			return false;
+	}
+}
+
+/**
+ * Optimize the single module, then split it into one part per build thread, each
+ * in a separate LLVM context so that the parts can be emitted in parallel.
+ *
+ * @param c the context holding the fully linked module.
+ * @return the contexts to emit, each marked as already optimized.
+ */
+static GenContext **llvm_split_module_for_codegen(GenContext *c)
+{
+	GenContext **parts = NULL;
+	llvm_optimize(c);
+	c->is_optimized = true;
+	unsigned threads = compiler.build.build_threads;
+	LLVMMemoryBufferRef *buffers = cmalloc(sizeof(LLVMMemoryBufferRef) * threads);
+	unsigned count = llvm_split_module(c->module, threads, buffers);
+	if (count < 2)
+	{
+		for (unsigned i = 0; i < count; i++) LLVMDisposeMemoryBuffer(buffers[i]);
+		free(buffers);
+		vec_add(parts, c);
+		return parts;
+	}
+	const char *extension = get_object_extension();
+	size_t base_len = strlen(c->object_filename) - strlen(extension);
+	for (unsigned i = 0; i < count; i++)
+	{
+		GenContext *part = cmalloc(sizeof(GenContext));
+		gencontext_init(part, c->code_module, NULL);
+		if (LLVMParseBitcodeInContext2(part->context, buffers[i], &part->module))
+		{
+			error_exit("Failed to read back split module %d.", i);
+		}
+		LLVMDisposeMemoryBuffer(buffers[i]);
+		part->machine = llvm_target_machine_create();
+		part->target_data = LLVMCreateTargetDataLayout(part->machine);
+		part->global_builder = LLVMCreateBuilderInContext(part->context);
+		part->builder = part->global_builder;
+		part->base_name = c->base_name;
+		part->object_filename = str_printf("%.*s_%u%s", (int)base_len, c->object_filename, i, extension);
+		part->is_optimized = true;
+		vec_add(parts, part);
+	}
+	free(buffers);
+	gencontext_end_module(c);
+	gencontext_destroy(c);
+	return parts;
+}
+
 void **llvm_gen(Module** modules, unsigned module_count)
 {
 	if (!module_count) return NULL;
@@ -1598,6 +1692,7 @@ void **llvm_gen(Module** modules, unsigned module_count)
 			gencontext_destroy(other);
 		}
 		vec_resize(gen_contexts, 1);
+		if (llvm_should_split_module()) return (void**)llvm_split_module_for_codegen(first);
 		return (void**)gen_contexts;
 	}
 	for (unsigned i = 0; i < module_count; i++)
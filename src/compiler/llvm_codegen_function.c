@@ -4,6 +4,7 @@
 
 
 #include "llvm_codegen_internal.h"
+#include <llvm-c/Comdat.h>
 
 static void llvm_append_xxlizer(GenContext *c, unsigned  priority, bool is_initializer, LLVMValueRef function);
 static inline void llvm_emit_return_value(GenContext *context, LLVMValueRef value);
@@ -11,6 +12,7 @@ static void llvm_expand_from_args(GenContext *c, Type *type, LLVMValueRef ref, u
 static inline void llvm_process_parameter_value(GenContext *c, Decl *decl, ABIArgInfo *info, unsigned *index);
 static inline void llvm_emit_func_parameter(GenContext *context, Decl *decl, ABIArgInfo ***abi_info_ref, unsigned *index, unsigned real_index);
 static inline void llvm_emit_body(GenContext *c, LLVMValueRef function, FunctionPrototype *prototype, Signature *signature, Ast *body, Decl *decl, bool is_naked);
+static void llvm_emit_target_clones(GenContext *c, Decl *decl);
 
 
 /**
@@ -488,6 +490,178 @@ void llvm_emit_function_body(GenContext *c, Decl *decl)
 	               type_get_resolved_prototype(decl->type),
 	               &decl->func_decl.signature,
 	               astptr(decl->func_decl.body), decl, decl->func_decl.attr_naked);
+	if (decl->attrs_resolved && decl->attrs_resolved->target_clones && target_clones_supported())
+	{
+		llvm_emit_target_clones(c, decl);
+	}
+}
+
+static void llvm_emit_cpuid(GenContext *c, LLVMBuilderRef builder, unsigned leaf, LLVMValueRef regs[4])
+{
+	LLVMTypeRef int_type = llvm_get_type(c, type_uint);
+	LLVMTypeRef reg_types[4] = { int_type, int_type, int_type, int_type };
+	LLVMTypeRef result_type = LLVMStructTypeInContext(c->context, reg_types, 4, false);
+	LLVMTypeRef param_types[2] = { int_type, int_type };
+	LLVMTypeRef func_type = LLVMFunctionType(result_type, param_types, 2, false);
+	static const char *constraints = "={ax},={bx},={cx},={dx},{ax},{cx},~{dirflag},~{fpsr},~{flags}";
+	LLVMValueRef asm_fn = LLVMGetInlineAsm(func_type, "cpuid", 5, (char *)constraints, strlen(constraints),
+	                                       false, false, LLVMInlineAsmDialectATT, false);
+	LLVMValueRef args[2] = { llvm_const_int(c, type_uint, leaf), llvm_const_int(c, type_uint, 0) };
+	LLVMValueRef result = LLVMBuildCall2(builder, func_type, asm_fn, args, 2, "cpuid");
+	for (unsigned i = 0; i < 4; i++) regs[i] = LLVMBuildExtractValue(builder, result, i, "");
+}
+
+static LLVMValueRef llvm_emit_bit_test(GenContext *c, LLVMBuilderRef builder, LLVMValueRef value, uint64_t mask)
+{
+	LLVMValueRef mask_val = llvm_const_int(c, type_uint, mask);
+	LLVMValueRef masked = LLVMBuildAnd(builder, value, mask_val, "");
+	return LLVMBuildICmp(builder, LLVMIntEQ, masked, mask_val, "");
+}
+
+/**
+ * Build the ifunc resolver: read the cpuid feature words once, then pick the first
+ * clone (in declaration order) whose features are all present, falling back to the default.
+ */
+static void llvm_emit_target_clone_resolver(GenContext *c, LLVMValueRef resolver, const char **targets, LLVMValueRef *clones, LLVMValueRef default_fn)
+{
+	LLVMBasicBlockRef entry;
+	LLVMBuilderRef builder = llvm_create_function_entry(c, resolver, &entry);
+	LLVMValueRef zero = llvm_get_zero(c, type_uint);
+	LLVMValueRef leaf0[4], leaf1[4], leaf7[4], ext0[4], ext1[4];
+	llvm_emit_cpuid(c, builder, 0, leaf0);
+	llvm_emit_cpuid(c, builder, 1, leaf1);
+	llvm_emit_cpuid(c, builder, 7, leaf7);
+	llvm_emit_cpuid(c, builder, 0x80000000, ext0);
+	llvm_emit_cpuid(c, builder, 0x80000001, ext1);
+
+	// Leaves beyond the max supported leaf return garbage, so mask them out.
+	LLVMValueRef has_leaf7 = LLVMBuildICmp(builder, LLVMIntUGE, leaf0[0], llvm_const_int(c, type_uint, 7), "");
+	LLVMValueRef has_ext1 = LLVMBuildICmp(builder, LLVMIntUGE, ext0[0], llvm_const_int(c, type_uint, 0x80000001), "");
+	LLVMValueRef words[CPUID_WORD_COUNT] = {
+		[CPUID_LEAF1_ECX] = leaf1[2],
+		[CPUID_LEAF7_EBX] = LLVMBuildSelect(builder, has_leaf7, leaf7[1], zero, ""),
+		[CPUID_LEAF7_ECX] = LLVMBuildSelect(builder, has_leaf7, leaf7[2], zero, ""),
+		[CPUID_EXT1_ECX] = LLVMBuildSelect(builder, has_ext1, ext1[2], zero, ""),
+	};
+
+	// XCR0 tells us if the OS saves the AVX / AVX-512 state, it may only be read with OSXSAVE set.
+	LLVMBasicBlockRef xgetbv_block = llvm_basic_block_new(c, "xgetbv");
+	LLVMBasicBlockRef select_block = llvm_basic_block_new(c, "select");
+	LLVMValueRef has_osxsave = llvm_emit_bit_test(c, builder, leaf1[2], 1u << 27);
+	LLVMBuildCondBr(builder, has_osxsave, xgetbv_block, select_block);
+
+	LLVMAppendExistingBasicBlock(resolver, xgetbv_block);
+	LLVMPositionBuilderAtEnd(builder, xgetbv_block);
+	LLVMTypeRef int_type = llvm_get_type(c, type_uint);
+	LLVMTypeRef xgetbv_types[2] = { int_type, int_type };
+	LLVMTypeRef xgetbv_type = LLVMFunctionType(LLVMStructTypeInContext(c->context, xgetbv_types, 2, false), &int_type, 1, false);
+	static const char *xgetbv_constraints = "={ax},={dx},{cx},~{dirflag},~{fpsr},~{flags}";
+	LLVMValueRef xgetbv = LLVMGetInlineAsm(xgetbv_type, "xgetbv", 6, (char *)xgetbv_constraints, strlen(xgetbv_constraints),
+	                                       false, false, LLVMInlineAsmDialectATT, false);
+	LLVMValueRef xcr0 = LLVMBuildExtractValue(builder, LLVMBuildCall2(builder, xgetbv_type, xgetbv, &zero, 1, "xgetbv"), 0, "");
+	LLVMBuildBr(builder, select_block);
+
+	LLVMAppendExistingBasicBlock(resolver, select_block);
+	LLVMPositionBuilderAtEnd(builder, select_block);
+	LLVMValueRef xcr0_phi = LLVMBuildPhi(builder, int_type, "xcr0");
+	LLVMValueRef xcr0_values[2] = { zero, xcr0 };
+	LLVMBasicBlockRef xcr0_blocks[2] = { entry, xgetbv_block };
+	LLVMAddIncoming(xcr0_phi, xcr0_values, xcr0_blocks, 2);
+	LLVMValueRef os_state[3] = {
+		[CPUID_OS_STATE_NONE] = NULL,
+		[CPUID_OS_STATE_AVX] = llvm_emit_bit_test(c, builder, xcr0_phi, 0x6),
+		[CPUID_OS_STATE_AVX512] = llvm_emit_bit_test(c, builder, xcr0_phi, 0xE6),
+	};
+
+	LLVMValueRef result = default_fn;
+	for (unsigned i = vec_size(targets); i > 0; i--)
+	{
+		LLVMValueRef cond = NULL;
+		const char *start = targets[i - 1];
+		while (true)
+		{
+			const char *end = strchr(start, ',');
+			const X86CloneFeature *feature = x86_clone_feature_find(start, end ? (size_t)(end - start) : strlen(start));
+			ASSERT(feature);
+			LLVMValueRef check = llvm_emit_bit_test(c, builder, words[feature->word], 1u << feature->bit);
+			if (os_state[feature->os_state]) check = LLVMBuildAnd(builder, check, os_state[feature->os_state], "");
+			cond = cond ? LLVMBuildAnd(builder, cond, check, "") : check;
+			if (!end) break;
+			start = end + 1;
+		}
+		result = LLVMBuildSelect(builder, cond, clones[i - 1], result, "");
+	}
+	LLVMBuildRet(builder, result);
+	LLVMDisposeBuilder(builder);
+}
+
+/**
+ * Emit @target_clones: the already emitted body becomes the default clone, each
+ * target gets its own copy compiled with extra target features, and the public
+ * symbol becomes an ifunc that picks one of them at load time.
+ */
+static void llvm_emit_target_clones(GenContext *c, Decl *decl)
+{
+	const char **targets = decl->attrs_resolved->target_clones;
+	unsigned count = vec_size(targets);
+	LLVMValueRef default_fn = decl->backend_ref;
+	LLVMTypeRef func_type = llvm_get_type(c, decl->type);
+	scratch_buffer_set_extern_decl_name(decl, true);
+	const char *name = scratch_buffer_copy();
+	LLVMLinkage linkage = LLVMGetLinkage(default_fn);
+	LLVMVisibility visibility = LLVMGetVisibility(default_fn);
+	LLVMComdatRef comdat = LLVMGetComdat(default_fn);
+
+	const char *default_name = str_printf("%s.default", name);
+	LLVMSetValueName2(default_fn, default_name, strlen(default_name));
+	LLVMSetLinkage(default_fn, LLVMInternalLinkage);
+	LLVMSetVisibility(default_fn, LLVMDefaultVisibility);
+
+	const char *resolver_name = str_printf("%s.resolver", name);
+	LLVMValueRef resolver = LLVMAddFunction(c->module, resolver_name, LLVMFunctionType(c->ptr_type, NULL, 0, false));
+	LLVMSetLinkage(resolver, LLVMInternalLinkage);
+	LLVMValueRef ifunc = LLVMAddGlobalIFunc(c->module, name, strlen(name), func_type, 0, resolver);
+	LLVMSetLinkage(ifunc, linkage);
+	LLVMSetVisibility(ifunc, visibility);
+	// Everything referring to the function so far should go through the dispatch.
+	LLVMReplaceAllUsesWith(default_fn, ifunc);
+	if (comdat)
+	{
+		LLVMSetComdat(ifunc, comdat);
+		LLVMSetComdat(resolver, comdat);
+	}
+
+	const char *base_features = compiler.platform.features;
+	LLVMValueRef *clones = MALLOC(sizeof(LLVMValueRef) * count);
+	FOREACH_IDX(i, const char *, target, targets)
+	{
+		scratch_buffer_clear();
+		scratch_buffer_printf("%s.", name);
+		for (const char *ch = target; *ch; ch++) scratch_buffer_append_char(*ch == ',' ? '_' : *ch);
+		LLVMValueRef clone = LLVMAddFunction(c->module, scratch_buffer_to_string(), func_type);
+		decl->backend_ref = clone;
+		llvm_append_function_attributes(c, decl);
+		LLVMSetLinkage(clone, LLVMInternalLinkage);
+		if (comdat) LLVMSetComdat(clone, comdat);
+		if (decl->attrs_resolved->section) LLVMSetSection(clone, decl->attrs_resolved->section);
+
+		scratch_buffer_clear();
+		if (base_features && base_features[0]) scratch_buffer_printf("%s,", base_features);
+		scratch_buffer_append_char('+');
+		for (const char *ch = target; *ch; ch++)
+		{
+			scratch_buffer_append_char(*ch);
+			if (*ch == ',') scratch_buffer_append_char('+');
+		}
+		llvm_attribute_add_string(c, clone, "target-features", scratch_buffer_to_string(), -1);
+
+		if (llvm_use_debug(c)) llvm_emit_debug_function(c, decl);
+		llvm_emit_body(c, clone, type_get_resolved_prototype(decl->type), &decl->func_decl.signature,
+		               astptr(decl->func_decl.body), decl, false);
+		clones[i] = clone;
+	}
+	llvm_emit_target_clone_resolver(c, resolver, targets, clones, default_fn);
+	decl->backend_ref = ifunc;
 }
 
 
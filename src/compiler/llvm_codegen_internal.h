@@ -82,6 +82,7 @@ typedef struct OptionalCatch_
 typedef struct GenContext_
 {
 	bool shared_context;
+	bool is_optimized;
 	bool in_init_ref;
 	bool emitting_load_store_check;
 	LLVMModuleRef module;
@@ -315,6 +316,7 @@ void gencontext_begin_module(GenContext *c);
 void gencontext_init_file_emit(GenContext *c, CompilationUnit *unit);
 void gencontext_end_file_emit(GenContext *c, CompilationUnit *ast);
 void gencontext_end_module(GenContext *context);
+const char *llvm_dwo_filename(const char *object_filename);
 
 
 #ifndef LLVMCreateTypeAttribute
@@ -388,6 +390,7 @@ void llvm_set_comdat(GenContext *c, LLVMValueRef global);
 void llvm_set_private_declaration(LLVMValueRef alloc);
 void llvm_set_decl_linkage(GenContext *c, Decl *decl);
 void llvm_set_weak(GenContext *c, LLVMValueRef global);
+void llvm_append_function_attributes(GenContext *c, Decl *decl);
 
 void llvm_set_internal_linkage(LLVMValueRef alloc);
 void llvm_set_global_tls(Decl *decl);
@@ -214,7 +214,7 @@ void gencontext_init_file_emit(GenContext *c, CompilationUnit *unit)
 		unsigned runtime_version = 0;
 		LLVMDWARFEmissionKind emission_kind =
 				compiler.build.debug_info == DEBUG_INFO_FULL ? LLVMDWARFEmissionFull : LLVMDWARFEmissionLineTablesOnly;
-		const char *debug_output_file = "";
+		const char *debug_output_file = split_debug_enabled() ? llvm_dwo_filename(c->object_filename) : "";
 		bool emit_debug_info_for_profiling = false;
 		bool split_debug_inlining = false;
 		const char *sysroot = "";
@@ -3255,6 +3255,7 @@ static bool sema_analyse_attribute(SemaContext *context, ResolvedAttrData *attr_
 			[ATTRIBUTE_SAFEINFER] = ATTR_GLOBAL | ATTR_LOCAL,
 			[ATTRIBUTE_SECTION] = ATTR_FUNC | ATTR_CONST | ATTR_GLOBAL,
 			[ATTRIBUTE_SIMD] = 0,
+			[ATTRIBUTE_TARGET_CLONES] = ATTR_FUNC,
 			[ATTRIBUTE_TAG] = ATTR_BITSTRUCT_MEMBER | ATTR_MEMBER | USER_DEFINED_TYPES | CALLABLE_TYPE | ATTR_LOCAL | ATTR_GLOBAL,
 			[ATTRIBUTE_TEST] = ATTR_FUNC,
 			[ATTRIBUTE_UNUSED] = (AttributeDomain)~(ATTR_CALL),
@@ -3272,7 +3273,7 @@ static bool sema_analyse_attribute(SemaContext *context, ResolvedAttrData *attr_
 	}
 
 	unsigned args = vec_size(attr->exprs);
-	if (args > 1 && type != ATTRIBUTE_LINK && type != ATTRIBUTE_TAG && type != ATTRIBUTE_WASM)
+	if (args > 1 && type != ATTRIBUTE_LINK && type != ATTRIBUTE_TAG && type != ATTRIBUTE_WASM && type != ATTRIBUTE_TARGET_CLONES)
 	{
 		RETURN_SEMA_ERROR(attr->exprs[1], "Too many arguments for the attribute.");
 	}
@@ -3409,6 +3410,30 @@ static bool sema_analyse_attribute(SemaContext *context, ResolvedAttrData *attr_
 				RETURN_SEMA_ERROR(attr, "'align' requires an power-of-2 argument, e.g. align(8).");
 			}
 			return sema_resolve_align_expr(context, expr, &decl->alignment);
+		case ATTRIBUTE_TARGET_CLONES:
+			if (!args) RETURN_SEMA_ERROR(attr, "'@target_clones' requires at least one target, e.g. @target_clones(\"avx2\", \"default\").");
+			if (attr_data->target_clones) RETURN_SEMA_ERROR(attr, "There can't be more than a single '@target_clones' attribute.");
+			FOREACH(Expr *, target, attr->exprs)
+			{
+				if (!sema_analyse_attribute_string_const(context, target)) return false;
+				const char *features = target->const_expr.bytes.ptr;
+				if (str_eq(features, "default")) continue;
+				// Each target is a comma separated list of features, e.g. "avx2,fma".
+				const char *start = features;
+				while (true)
+				{
+					const char *end = strchr(start, ',');
+					size_t len = end ? (size_t)(end - start) : strlen(start);
+					if (!x86_clone_feature_find(start, len))
+					{
+						RETURN_SEMA_ERROR(target, "'%.*s' is not a supported '@target_clones' feature.", (int)len, start);
+					}
+					if (!end) break;
+					start = end + 1;
+				}
+				vec_add(attr_data->target_clones, features);
+			}
+			return true;
 		case ATTRIBUTE_WASM:
 			if (args > 2) RETURN_SEMA_ERROR(attr->exprs[2], "Too many arguments to '@wasm', expected 0, 1 or 2 arguments");
 			decl->is_export = true;
@@ -3828,7 +3853,7 @@ bool sema_analyse_attributes(SemaContext *context, Decl *decl, Attr **attrs, Att
 	if (!sema_analyse_attributes_inner(context, &data, decl, attrs, domain, NULL, erase_decl)) return false;
 	if (*erase_decl) return true;
 	decl->resolved_attributes = true;
-	if (data.tags || data.deprecated || data.links || data.section || data.overload || data.wasm_module )
+	if (data.tags || data.deprecated || data.links || data.section || data.overload || data.wasm_module || data.target_clones)
 	{
 		ResolvedAttrData *copy = MALLOCS(ResolvedAttrData);
 		*copy = data;
@@ -4359,6 +4384,14 @@ static inline bool sema_analyse_func(SemaContext *context, Decl *decl, bool *era
 		}
 	}
 CHECK_DONE:
+	if (decl->attrs_resolved && decl->attrs_resolved->target_clones)
+	{
+		if (!decl->func_decl.body) RETURN_SEMA_ERROR(decl, "'@target_clones' can only be used on functions with a body.");
+		if (decl->func_decl.attr_naked || is_init_finalizer || is_test || is_benchmark)
+		{
+			RETURN_SEMA_ERROR(decl, "'@target_clones' cannot be combined with '@naked', '@init', '@finalizer', '@test' or '@benchmark'.");
+		}
+	}
 	decl->type = type_new_func(decl, sig);
 	if (!sema_analyse_function_signature(context, decl, type_infoptrzero(decl->func_decl.type_parent), sig->abi, sig)) return decl_poison(decl);
 	TypeInfo *rtype_info = type_infoptr(sig->rtype);
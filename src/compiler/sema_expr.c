@@ -46,6 +46,16 @@ typedef struct
 	Decl *generic_instance;
 } ContextSwitchState;
 
+typedef struct MacroFold_
+{
+	Module *module;
+	CallEnvKind env_kind;
+	bool pure;
+	Expr **args;
+	Expr *result;
+	struct MacroFold_ *next;
+} MacroFold;
+
 // Properties
 static inline BuiltinFunction builtin_by_name(const char *name);
 static inline bool sema_expr_analyse_subscript(SemaContext *context, Expr *expr, bool *failed_ref);
@@ -2980,6 +2990,122 @@ static inline bool sema_expr_setup_call_analysis(SemaContext *context, CalledDec
 
 	return true;
 }
+
+static inline bool sema_macro_fold_arg_is_key(Expr *arg)
+{
+	if (!arg) return true;
+	if (!expr_is_const(arg)) return false;
+	switch (arg->const_expr.const_kind)
+	{
+		case CONST_FLOAT:
+		case CONST_INTEGER:
+		case CONST_BOOL:
+		case CONST_ENUM:
+		case CONST_FAULT:
+		case CONST_BYTES:
+		case CONST_STRING:
+		case CONST_POINTER:
+		case CONST_TYPEID:
+			return true;
+		default:
+			return false;
+	}
+}
+
+static inline bool sema_macro_fold_arg_equal(Expr *arg, Expr *key)
+{
+	if (!arg || !key) return arg == key;
+	if (arg->type != key->type) return false;
+	ExprConst *left = &arg->const_expr;
+	ExprConst *right = &key->const_expr;
+	if (left->const_kind != right->const_kind) return false;
+	if (left->is_character != right->is_character || left->is_hex != right->is_hex) return false;
+	switch (left->const_kind)
+	{
+		case CONST_FLOAT:
+			// Compare the bits, so that 0.0 and -0.0 are kept apart.
+			return left->fxx.type == right->fxx.type && !memcmp(&left->fxx.f, &right->fxx.f, sizeof(Real));
+		case CONST_INTEGER:
+			return int_comp(left->ixx, right->ixx, BINARYOP_EQ);
+		case CONST_BOOL:
+			return left->b == right->b;
+		case CONST_ENUM:
+			return left->enum_val == right->enum_val;
+		case CONST_FAULT:
+			return left->fault == right->fault;
+		case CONST_BYTES:
+		case CONST_STRING:
+			if (left->bytes.len != right->bytes.len) return false;
+			if (!left->bytes.len || left->bytes.ptr == right->bytes.ptr) return true;
+			return !memcmp(left->bytes.ptr, right->bytes.ptr, left->bytes.len);
+		case CONST_POINTER:
+			return left->ptr == right->ptr;
+		case CONST_TYPEID:
+			return left->typeid == right->typeid;
+		default:
+			UNREACHABLE
+	}
+}
+
+/**
+ * A macro that is only passed compile time values and folds to a constant is pure, so
+ * the result for a given set of arguments can be reused rather than analysing a new
+ * copy of the body. This checks whether the call qualifies and if so creates the key.
+ */
+static bool sema_macro_fold_key(Expr *call_expr, Decl **params, Expr **args, bool has_optional_arg, Expr ***key_ref)
+{
+	if (has_optional_arg || call_expr->call_expr.macro_body || call_expr->call_expr.is_outer_call) return false;
+	FOREACH_IDX(i, Decl *, param, params)
+	{
+		// Raw varargs
+		if (!param) return false;
+		switch (param->var.kind)
+		{
+			case VARDECL_PARAM_CT:
+			case VARDECL_PARAM_CT_TYPE:
+				break;
+			default:
+				return false;
+		}
+		if (!sema_macro_fold_arg_is_key(args[i])) return false;
+	}
+	// Copy the arguments, since the body may assign to the compile time parameters.
+	Expr **key = NULL;
+	unsigned param_count = vec_size(params);
+	for (unsigned i = 0; i < param_count; i++)
+	{
+		vec_add(key, args[i] ? copy_expr_single(args[i]) : NULL);
+	}
+	*key_ref = key;
+	return true;
+}
+
+static MacroFold *sema_macro_fold_find(SemaContext *context, Decl *macro, Module *module, Expr **args, unsigned arg_count)
+{
+	MacroFold *fold = htable_get(&compiler.context.macro_folds, macro);
+	for (; fold; fold = fold->next)
+	{
+		if (fold->module != module || fold->env_kind != context->call_env.kind || fold->pure != context->call_env.pure) continue;
+		for (unsigned i = 0; i < arg_count; i++)
+		{
+			if (!sema_macro_fold_arg_equal(args[i], fold->args[i])) goto NEXT;
+		}
+		return fold;
+NEXT:;
+	}
+	return NULL;
+}
+
+static void sema_macro_fold_add(SemaContext *context, Decl *macro, Module *module, Expr **key, Expr *result)
+{
+	MacroFold *fold = CALLOCS(MacroFold);
+	*fold = (MacroFold) { .module = module, .env_kind = context->call_env.kind, .pure = context->call_env.pure,
+	                      .args = key, .result = copy_expr_single(result) };
+	fold->result->resolve_status = RESOLVE_DONE;
+	fold->next = htable_get(&compiler.context.macro_folds, macro);
+	htable_set(&compiler.context.macro_folds, macro, fold);
+}
+
 bool sema_expr_analyse_macro_call(SemaContext *context, Expr *call_expr, Expr *struct_var, Decl *decl,
 								  bool call_var_optional, bool *no_match_ref)
 {
@@ -3019,12 +3145,6 @@ bool sema_expr_analyse_macro_call(SemaContext *context, Expr *call_expr, Expr *s
 
 	copy_begin();
 	Decl **params = copy_decl_list_macro(decl->func_decl.signature.params);
-	Ast *body = copy_ast_macro(astptr(decl->func_decl.body));
-	Decl *contracts = declptrzero(decl->docs);
-	Expr **requires = contracts ? contracts->contracts_decl.requires : NULL;
-	Expr **ensures = contracts ? contracts->contracts_decl.ensures : NULL;
-	if (requires) requires = copy_exprlist_macro(requires);
-	if (ensures) ensures = copy_exprlist_macro(ensures);
 	Signature *sig = &decl->func_decl.signature;
 	copy_end();
 	CalledDecl callee = {
@@ -3071,6 +3191,31 @@ bool sema_expr_analyse_macro_call(SemaContext *context, Expr *call_expr, Expr *s
 		has_optional_arg = has_optional_arg || IS_OPTIONAL(args[i]);
 	}
 
+	Module *fold_module = context->original_module ? context->original_module : context->compilation_unit->module;
+	Expr **fold_key = NULL;
+	bool may_fold = sema_macro_fold_key(call_expr, params, args, has_optional_arg, &fold_key);
+	if (may_fold)
+	{
+		MacroFold *fold = sema_macro_fold_find(context, decl, fold_module, fold_key, vec_size(params));
+		if (fold)
+		{
+			expr_replace(call_expr, copy_expr_single(fold->result));
+			call_expr->resolve_status = RESOLVE_DONE;
+			return true;
+		}
+	}
+
+	// The body and contracts are only copied once we know the call is not folded.
+	copy_begin_macro_resume(decl->func_decl.signature.params, params);
+	Ast *body = copy_ast_macro(astptr(decl->func_decl.body));
+	Decl *contracts = declptrzero(decl->docs);
+	Expr **requires = contracts ? contracts->contracts_decl.requires : NULL;
+	Expr **ensures = contracts ? contracts->contracts_decl.ensures : NULL;
+	if (requires) requires = copy_exprlist_macro(requires);
+	if (ensures) ensures = copy_exprlist_macro(ensures);
+	copy_end();
+	unsigned call_site_builtins_used = compiler.context.call_site_builtins_used;
+
 	Expr *macro_body = exprptrzero(call_expr->call_expr.macro_body);
 	Decl **body_params = macro_body ? macro_body->macro_body_expr.body_arguments : NULL;
 	unsigned body_params_count = vec_size(body_params);
@@ -3374,6 +3519,11 @@ bool sema_expr_analyse_macro_call(SemaContext *context, Expr *call_expr, Expr *s
 		if (ast_is_compile_time(body))
 		{
 			expr_replace(call_expr, result);
+			// Results depending on the call site, such as $$LINE, may not be reused.
+			if (may_fold && expr_is_const(call_expr) && call_site_builtins_used == compiler.context.call_site_builtins_used)
+			{
+				sema_macro_fold_add(context, decl, fold_module, fold_key, call_expr);
+			}
 			goto EXIT;
 		}
 	}
@@ -10518,6 +10668,19 @@ static inline bool sema_expr_analyse_compiler_const(SemaContext *context, Expr *
 		}
 	}
 	switch (def)
+	{
+		case BUILTIN_DEF_FILE:
+		case BUILTIN_DEF_FILEPATH:
+		case BUILTIN_DEF_FUNC:
+		case BUILTIN_DEF_FUNCTION:
+		case BUILTIN_DEF_LINE:
+			// Prevents folded macro results from being reused at other call sites.
+			compiler.context.call_site_builtins_used++;
+			break;
+		default:
+			break;
+	}
+	switch (def)
 	{
 		case BUILTIN_DEF_TIME:
 			expr_rewrite_const_string_from_raw(expr, time_get());
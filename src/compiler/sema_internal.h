@@ -87,6 +87,9 @@ void sema_analysis_pass_interface_and_weak_sym(Module *module);
 void sema_analysis_pass_lambda(Module *module);
 void sema_analyze_stage(Module *module, AnalysisStage stage);
 void sema_trace_liveness(void);
+void sema_range_analyse_for(SemaContext *context, Ast *statement);
+void sema_range_analyse_foreach(SemaContext *context, Ast *statement, Decl *index, Decl *collection);
+void sema_range_resolve_proofs(Ast *body, unsigned first_proof);
 
 Expr *sema_expr_resolve_access_child(SemaContext *context, Expr *child, bool *missing, bool *was_reflect);
 
@@ -0,0 +1,647 @@
+// Copyright (c) 2026 Christoffer Lerno and contributors. All rights reserved.
+// Use of this source code is governed by the GNU LGPLv3.0 license
+// a copy of which can be found in the LICENSE file.
+
+#include "sema_internal.h"
+
+// Range analysis for loop induction variables, used to prove that subscripts
+// in a loop body can never be out of bounds so that the safe mode bounds
+// check can be removed. A loop is only considered if neither the induction
+// variable nor the subscripted slice is written inside the body. Because a
+// pointer to either could be used to modify them anywhere, the final decision
+// is taken when the entire function has been analysed and we can verify that
+// their address is never taken.
+
+typedef struct
+{
+	Decl **watched;
+	Decl **clobbered;
+	Decl *index;
+	Expr **subscripts;
+	bool check_writes;
+} RangeWalk;
+
+static void range_walk_expr(RangeWalk *walk, Expr *expr);
+static void range_walk_stmt(RangeWalk *walk, Ast *ast);
+
+static inline bool range_decl_in_list(Decl **list, Decl *decl)
+{
+	FOREACH(Decl *, d, list)
+	{
+		if (d == decl) return true;
+	}
+	return false;
+}
+
+static void range_clobber(RangeWalk *walk, Decl *decl)
+{
+	if (!decl || !range_decl_in_list(walk->watched, decl)) return;
+	if (range_decl_in_list(walk->clobbered, decl)) return;
+	vec_add(walk->clobbered, decl);
+}
+
+static void range_clobber_all(RangeWalk *walk)
+{
+	FOREACH(Decl *, watched, walk->watched) range_clobber(walk, watched);
+}
+
+/**
+ * Find the variable that is modified when assigning to or taking the address of expr,
+ * returns NULL if the storage isn't a variable, e.g. *ptr or slice[1]
+ */
+static Decl *range_lvalue_root(Expr *expr)
+{
+RETRY:
+	switch (expr->expr_kind)
+	{
+		case EXPR_IDENTIFIER:
+			return expr->ident_expr->decl_kind == DECL_VAR ? decl_raw(expr->ident_expr) : NULL;
+		case EXPR_ACCESS_RESOLVED:
+		case EXPR_BITACCESS:
+			expr = expr->access_resolved_expr.parent;
+			goto RETRY;
+		case EXPR_SWIZZLE:
+			expr = exprptr(expr->swizzle_expr.parent);
+			goto RETRY;
+		default:
+			return NULL;
+	}
+}
+
+/**
+ * Remove conversions that preserve the value of a non-negative integer,
+ * that is casts which strictly widen or which keep the signedness.
+ * A same size cast that changes the sign, like (int) on a uint, is kept.
+ */
+static Expr *range_strip_widening(Expr *expr)
+{
+	while (expr->expr_kind == EXPR_EXT_TRUNC)
+	{
+		Expr *inner = expr->ext_trunc_expr.inner;
+		Type *to = type_flatten(expr->type);
+		Type *from = type_flatten(inner->type);
+		TypeSize to_size = type_size(to);
+		TypeSize from_size = type_size(from);
+		if (to_size < from_size) break;
+		if (to_size == from_size && type_is_signed(to) != type_is_signed(from)) break;
+		expr = inner;
+	}
+	return expr;
+}
+
+static Decl *range_ident_var(Expr *expr)
+{
+	expr = range_strip_widening(expr);
+	if (expr->expr_kind != EXPR_IDENTIFIER || expr->ident_expr->decl_kind != DECL_VAR) return NULL;
+	return decl_raw(expr->ident_expr);
+}
+
+static void range_walk_expr_list(RangeWalk *walk, Expr **exprs)
+{
+	FOREACH(Expr *, expr, exprs) range_walk_expr(walk, expr);
+}
+
+static void range_walk_chain(RangeWalk *walk, AstId current)
+{
+	while (current)
+	{
+		range_walk_stmt(walk, ast_next(&current));
+	}
+}
+
+static void range_walk_decl(RangeWalk *walk, Decl *decl)
+{
+	if (!decl) return;
+	switch (decl->decl_kind)
+	{
+		case DECL_DECLARRAY:
+			FOREACH(Decl *, d, decl->decls) range_walk_decl(walk, d);
+			return;
+		case DECL_VAR:
+			break;
+		default:
+			return;
+	}
+	switch (decl->var.kind)
+	{
+		case VARDECL_PARAM_CT_TYPE:
+		case VARDECL_LOCAL_CT_TYPE:
+		case VARDECL_REWRAPPED:
+		case VARDECL_UNWRAPPED:
+		case VARDECL_PARAM_EXPR:
+			return;
+		default:
+			if (decl->var.init_expr && decl->var.init_expr->resolve_status == RESOLVE_DONE)
+			{
+				range_walk_expr(walk, decl->var.init_expr);
+			}
+			return;
+	}
+}
+
+static void range_walk_stmt(RangeWalk *walk, Ast *ast)
+{
+	if (!ast) return;
+	switch (ast->ast_kind)
+	{
+		case AST_POISONED:
+		case CT_AST:
+		case AST_FOREACH_STMT:
+		case AST_ASM_STMT:
+		case AST_ASM_BLOCK_STMT:
+			range_clobber_all(walk);
+			return;
+		case AST_NOP_STMT:
+		case AST_ASM_LABEL:
+			return;
+		case AST_DEFER_STMT:
+			range_walk_stmt(walk, astptr(ast->defer_stmt.body));
+			return;
+		case AST_CT_COMPOUND_STMT:
+			range_walk_chain(walk, ast->ct_compound_stmt);
+			return;
+		case AST_COMPOUND_STMT:
+			range_walk_chain(walk, ast->compound_stmt.first_stmt);
+			return;
+		case AST_EXPR_STMT:
+			range_walk_expr(walk, ast->expr_stmt);
+			return;
+		case AST_DECLARE_STMT:
+			range_walk_decl(walk, ast->declare_stmt);
+			return;
+		case AST_DECLS_STMT:
+			FOREACH(Decl *, decl, ast->decls_stmt) range_walk_decl(walk, decl);
+			return;
+		case AST_RETURN_STMT:
+		case AST_BLOCK_EXIT_STMT:
+			range_walk_expr(walk, ast->return_stmt.expr);
+			range_walk_chain(walk, ast->return_stmt.cleanup);
+			if (ast->return_stmt.cleanup != ast->return_stmt.cleanup_fail)
+			{
+				range_walk_chain(walk, ast->return_stmt.cleanup_fail);
+			}
+			return;
+		case AST_ASSERT_STMT:
+			range_walk_expr(walk, exprptrzero(ast->assert_stmt.expr));
+			range_walk_expr(walk, exprptrzero(ast->assert_stmt.message));
+			range_walk_expr_list(walk, ast->assert_stmt.args);
+			return;
+		case AST_FOR_STMT:
+			range_walk_expr(walk, exprptrzero(ast->for_stmt.init));
+			range_walk_expr(walk, exprptrzero(ast->for_stmt.cond));
+			range_walk_expr(walk, exprptrzero(ast->for_stmt.incr));
+			range_walk_stmt(walk, astptrzero(ast->for_stmt.body));
+			return;
+		case AST_IF_STMT:
+			range_walk_expr(walk, exprptrzero(ast->if_stmt.cond));
+			range_walk_stmt(walk, astptrzero(ast->if_stmt.then_body));
+			range_walk_stmt(walk, astptrzero(ast->if_stmt.else_body));
+			return;
+		case AST_SWITCH_STMT:
+			range_walk_expr(walk, exprptrzero(ast->switch_stmt.cond));
+			FOREACH(Ast *, case_stmt, ast->switch_stmt.cases) range_walk_stmt(walk, case_stmt);
+			return;
+		case AST_CASE_STMT:
+			range_walk_expr(walk, exprptrzero(ast->case_stmt.expr));
+			range_walk_expr(walk, exprptrzero(ast->case_stmt.to_expr));
+			range_walk_stmt(walk, ast->case_stmt.body);
+			return;
+		case AST_DEFAULT_STMT:
+			range_walk_stmt(walk, ast->case_stmt.body);
+			return;
+		case AST_NEXTCASE_STMT:
+			range_walk_chain(walk, ast->nextcase_stmt.defer_id);
+			range_walk_expr(walk, ast->nextcase_stmt.switch_expr);
+			return;
+		case AST_BREAK_STMT:
+		case AST_CONTINUE_STMT:
+			range_walk_chain(walk, ast->contbreak_stmt.defers);
+			return;
+	}
+	UNREACHABLE_VOID
+}
+
+static void range_walk_expr(RangeWalk *walk, Expr *expr)
+{
+RETRY:
+	if (!expr) return;
+	switch (expr->expr_kind)
+	{
+		case NON_RUNTIME_EXPR:
+		case EXPR_SUBSCRIPT_ASSIGN:
+		case EXPR_OPERATOR_CHARS:
+		case EXPR_MEMBER_GET:
+		case EXPR_MEMBER_SET:
+		case EXPR_NAMED_ARGUMENT:
+		case EXPR_NAMED_EVAL_ARGUMENT:
+		case UNRESOLVED_EXPRS:
+		case EXPR_LAMBDA:
+		case EXPR_ASM:
+			range_clobber_all(walk);
+			return;
+		case EXPR_BUILTIN:
+		case EXPR_CONST:
+		case EXPR_IDENTIFIER:
+		case EXPR_NOP:
+		case EXPR_RETVAL:
+		case EXPR_BENCHMARK_HOOK:
+		case EXPR_TEST_HOOK:
+		case EXPR_LAST_FAULT:
+			return;
+		case EXPR_TWO:
+			range_walk_expr(walk, expr->two_expr.first);
+			expr = expr->two_expr.last;
+			goto RETRY;
+		case EXPR_DESIGNATOR:
+			expr = expr->designator_expr.value;
+			goto RETRY;
+		case EXPR_MAKE_SLICE:
+			expr = expr->make_slice_expr.ptr;
+			goto RETRY;
+		case EXPR_MAKE_ANY:
+			range_walk_expr(walk, expr->make_any_expr.typeid);
+			expr = expr->make_any_expr.inner;
+			goto RETRY;
+		case EXPR_ACCESS_RESOLVED:
+		case EXPR_BITACCESS:
+			expr = expr->access_resolved_expr.parent;
+			goto RETRY;
+		case EXPR_BINARY:
+		case EXPR_BITASSIGN:
+		{
+			Expr *left = exprptr(expr->binary_expr.left);
+			if (walk->check_writes && (expr->expr_kind == EXPR_BITASSIGN || expr->binary_expr.operator >= BINARYOP_ASSIGN))
+			{
+				range_clobber(walk, range_lvalue_root(left));
+			}
+			range_walk_expr(walk, left);
+			expr = exprptr(expr->binary_expr.right);
+			goto RETRY;
+		}
+		case EXPR_CALL:
+			range_walk_expr_list(walk, expr->call_expr.arguments);
+			if (expr->call_expr.varargs)
+			{
+				if (expr->call_expr.va_is_splat)
+				{
+					range_walk_expr(walk, expr->call_expr.vasplat);
+				}
+				else
+				{
+					range_walk_expr_list(walk, expr->call_expr.varargs);
+				}
+			}
+			if (expr->call_expr.is_builtin) return;
+			if (expr->call_expr.is_func_ref)
+			{
+				range_walk_stmt(walk, astptrzero(expr->call_expr.function_contracts));
+				return;
+			}
+			expr = exprptr(expr->call_expr.function);
+			goto RETRY;
+		case EXPR_FORCE_UNWRAP:
+		case EXPR_RETHROW:
+		case EXPR_OPTIONAL:
+		case EXPR_VECTOR_TO_ARRAY:
+		case EXPR_SLICE_TO_VEC_ARRAY:
+		case EXPR_SCALAR_TO_VECTOR:
+		case EXPR_PTR_ACCESS:
+		case EXPR_ENUM_FROM_ORD:
+		case EXPR_FLOAT_TO_INT:
+		case EXPR_INT_TO_FLOAT:
+		case EXPR_INT_TO_PTR:
+		case EXPR_PTR_TO_INT:
+		case EXPR_SLICE_LEN:
+		case EXPR_VECTOR_FROM_ARRAY:
+		case EXPR_RVALUE:
+		case EXPR_RECAST:
+		case EXPR_DISCARD:
+		case EXPR_ADDR_CONVERSION:
+			expr = expr->inner_expr;
+			goto RETRY;
+		case EXPR_DEFAULT_ARG:
+			expr = expr->default_arg_expr.inner;
+			goto RETRY;
+		case EXPR_BUILTIN_ACCESS:
+			expr = exprptr(expr->builtin_access_expr.inner);
+			goto RETRY;
+		case EXPR_CATCH:
+			range_walk_decl(walk, expr->catch_expr.decl);
+			range_walk_expr_list(walk, expr->catch_expr.exprs);
+			return;
+		case EXPR_COND:
+			range_walk_expr_list(walk, expr->cond_expr);
+			return;
+		case EXPR_DECL:
+			range_walk_decl(walk, expr->decl_expr);
+			return;
+		case EXPR_EXPRESSION_LIST:
+			range_walk_expr_list(walk, expr->expression_list);
+			return;
+		case EXPR_DESIGNATED_INITIALIZER_LIST:
+			range_walk_expr(walk, expr->designated_init.splat);
+			range_walk_expr_list(walk, expr->designated_init.list);
+			return;
+		case EXPR_INITIALIZER_LIST:
+			range_walk_expr_list(walk, expr->initializer_list);
+			return;
+		case EXPR_MACRO_BLOCK:
+			FOREACH(Decl *, param, expr->macro_block.params) range_walk_decl(walk, param);
+			range_walk_chain(walk, expr->macro_block.first_stmt);
+			return;
+		case EXPR_MACRO_BODY_EXPANSION:
+			FOREACH(Decl *, decl, expr->body_expansion_expr.declarations) range_walk_decl(walk, decl);
+			range_walk_expr_list(walk, expr->body_expansion_expr.values);
+			range_walk_stmt(walk, astptrzero(expr->body_expansion_expr.first_stmt));
+			return;
+		case EXPR_POINTER_OFFSET:
+			range_walk_expr(walk, exprptr(expr->pointer_offset_expr.ptr));
+			expr = exprptr(expr->pointer_offset_expr.offset);
+			goto RETRY;
+		case EXPR_POST_UNARY:
+		case EXPR_UNARY:
+			switch (expr->unary_expr.operator)
+			{
+				case UNARYOP_ADDR:
+					// Taking the address always counts, since it allows the variable to be changed anywhere.
+					range_clobber(walk, range_lvalue_root(expr->unary_expr.expr));
+					break;
+				case UNARYOP_INC:
+				case UNARYOP_DEC:
+					if (walk->check_writes) range_clobber(walk, range_lvalue_root(expr->unary_expr.expr));
+					break;
+				default:
+					break;
+			}
+			expr = expr->unary_expr.expr;
+			goto RETRY;
+		case EXPR_SLICE_ASSIGN:
+		case EXPR_SLICE_COPY:
+			range_walk_expr(walk, exprptr(expr->slice_assign_expr.left));
+			expr = exprptr(expr->slice_assign_expr.right);
+			goto RETRY;
+		case EXPR_SLICE:
+			range_walk_expr(walk, exprptr(expr->slice_expr.expr));
+			switch (expr->slice_expr.range.range_type)
+			{
+				case RANGE_SINGLE_ELEMENT:
+				case RANGE_CONST_RANGE:
+					return;
+				case RANGE_DYNAMIC:
+					range_walk_expr(walk, exprptr(expr->slice_expr.range.start));
+					expr = exprptrzero(expr->slice_expr.range.end);
+					goto RETRY;
+				case RANGE_CONST_END:
+				case RANGE_CONST_LEN:
+					expr = exprptr(expr->slice_expr.range.start);
+					goto RETRY;
+			}
+			UNREACHABLE_VOID
+		case EXPR_SUBSCRIPT:
+		case EXPR_SUBSCRIPT_ADDR:
+		{
+			Expr *index = exprptr(expr->subscript_expr.index.expr);
+			if (walk->index && !expr->subscript_expr.index.start_from_end && range_ident_var(index) == walk->index)
+			{
+				vec_add(walk->subscripts, expr);
+			}
+			range_walk_expr(walk, exprptr(expr->subscript_expr.expr));
+			expr = index;
+			goto RETRY;
+		}
+		case EXPR_SWIZZLE:
+			expr = exprptr(expr->swizzle_expr.parent);
+			goto RETRY;
+		case EXPR_TERNARY:
+			range_walk_expr(walk, exprptr(expr->ternary_expr.cond));
+			range_walk_expr(walk, exprptrzero(expr->ternary_expr.then_expr));
+			expr = exprptr(expr->ternary_expr.else_expr);
+			goto RETRY;
+		case EXPR_TYPEID_INFO:
+			expr = exprptrzero(expr->typeid_info_expr.parent);
+			goto RETRY;
+		case EXPR_TRY:
+			if (expr->try_expr.assign_existing)
+			{
+				if (walk->check_writes) range_clobber(walk, range_lvalue_root(expr->try_expr.lhs));
+				range_walk_expr(walk, expr->try_expr.lhs);
+			}
+			else
+			{
+				range_walk_decl(walk, expr->try_expr.decl);
+			}
+			expr = expr->try_expr.optional;
+			goto RETRY;
+		case EXPR_TRY_UNWRAP_CHAIN:
+			range_walk_expr_list(walk, expr->try_unwrap_chain_expr);
+			return;
+		case EXPR_INT_TO_BOOL:
+			expr = expr->int_to_bool_expr.inner;
+			goto RETRY;
+		case EXPR_EXT_TRUNC:
+			expr = expr->ext_trunc_expr.inner;
+			goto RETRY;
+	}
+	UNREACHABLE_VOID
+}
+
+/**
+ * Only plain, non-optional, runtime locals are tracked: anything else may be changed
+ * behind our back (globals, statics) or is aliased (unwrapped optionals).
+ */
+static bool range_is_trackable(Decl *decl)
+{
+	if (!decl || decl->decl_kind != DECL_VAR) return false;
+	switch (decl->var.kind)
+	{
+		case VARDECL_LOCAL:
+			if (decl->var.is_static || decl->var.is_threadlocal) return false;
+			break;
+		case VARDECL_PARAM:
+			break;
+		default:
+			return false;
+	}
+	return !type_is_optional(decl->type);
+}
+
+static void range_add_proofs(RangeWalk *walk, Decl *collection, ArraySize min_len)
+{
+	FOREACH(Expr *, subscript, walk->subscripts)
+	{
+		Expr *parent = exprptr(subscript->subscript_expr.expr);
+		Type *type = type_flatten(type_no_optional(parent->type));
+		if (type->type_kind == TYPE_SLICE)
+		{
+			if (!collection || range_ident_var(parent) != collection) continue;
+		}
+		else if (type->type_kind != TYPE_ARRAY && !type_kind_is_real_vector(type->type_kind))
+		{
+			continue;
+		}
+		else if (!min_len || type->array.len < min_len)
+		{
+			continue;
+		}
+		vec_add(compiler.context.range_proofs, ((RangeProof) { .subscript = subscript, .index = walk->index, .collection = collection }));
+	}
+}
+
+/**
+ * Look for the form 'for (...; i < s.len; ...)' or 'for (...; i < CONST; ...)'
+ * where neither i nor s is changed in the body.
+ *
+ * - If i is unsigned, then 'i < s.len' holds for every iteration, regardless of how
+ *   i is initialized or updated.
+ * - If i is signed, then it must start at a constant >= 0 and be incremented by one
+ *   without being able to overflow before reaching the bound.
+ */
+void sema_range_analyse_for(SemaContext *context, Ast *statement)
+{
+	if (!safe_mode_enabled() || context->call_env.kind != CALL_ENV_FUNCTION) return;
+	if (statement->for_stmt.flow.skip_first || !statement->for_stmt.cond) return;
+
+	Expr *cond = exprptr(statement->for_stmt.cond);
+	if (cond->expr_kind == EXPR_COND)
+	{
+		if (vec_size(cond->cond_expr) != 1) return;
+		cond = cond->cond_expr[0];
+	}
+	if (cond->expr_kind != EXPR_BINARY) return;
+	Expr *index_expr;
+	Expr *bound;
+	switch (cond->binary_expr.operator)
+	{
+		case BINARYOP_LT:
+			index_expr = exprptr(cond->binary_expr.left);
+			bound = exprptr(cond->binary_expr.right);
+			break;
+		case BINARYOP_GT:
+			index_expr = exprptr(cond->binary_expr.right);
+			bound = exprptr(cond->binary_expr.left);
+			break;
+		default:
+			return;
+	}
+	Decl *index = range_ident_var(index_expr);
+	if (!range_is_trackable(index)) return;
+	Type *index_type = type_flatten(index->type);
+	if (!type_is_integer(index_type)) return;
+
+	// Figure out what the bound is.
+	bound = range_strip_widening(bound);
+	Decl *collection = NULL;
+	ArraySize min_len = 0;
+	if (bound->expr_kind == EXPR_SLICE_LEN)
+	{
+		collection = range_ident_var(bound->inner_expr);
+		if (!range_is_trackable(collection)) return;
+	}
+	else if (expr_is_const_int(bound))
+	{
+		Int value = bound->const_expr.ixx;
+		if (int_is_neg(value) || int_is_zero(value) || !int_fits(value, TYPE_U32)) return;
+		// A signed index must not be able to wrap before reaching the bound.
+		if (type_is_signed(index_type) && !int_fits(value, index_type->type_kind)) return;
+		min_len = (ArraySize)int_to_u64(value);
+	}
+	else
+	{
+		return;
+	}
+
+	if (type_is_signed(index_type))
+	{
+		if (collection && type_size(index_type) < type_size(type_usz)) return;
+		// The increment must be exactly ++i or i++
+		Expr *incr = exprptrzero(statement->for_stmt.incr);
+		if (!incr) return;
+		if (incr->expr_kind == EXPR_EXPRESSION_LIST)
+		{
+			if (vec_size(incr->expression_list) != 1) return;
+			incr = incr->expression_list[0];
+		}
+		if (incr->expr_kind != EXPR_UNARY && incr->expr_kind != EXPR_POST_UNARY) return;
+		if (incr->unary_expr.operator != UNARYOP_INC || range_ident_var(incr->unary_expr.expr) != index) return;
+		// And it must be declared in the init with a non-negative constant.
+		Expr *init = index->var.init_expr;
+		if (!init || !statement->for_stmt.init || !expr_is_const_int(init) || int_is_neg(init->const_expr.ixx)) return;
+		Expr *init_list = exprptr(statement->for_stmt.init);
+		bool found = false;
+		if (init_list->expr_kind == EXPR_DECL)
+		{
+			found = init_list->decl_expr == index;
+		}
+		else if (init_list->expr_kind == EXPR_EXPRESSION_LIST)
+		{
+			FOREACH(Expr *, e, init_list->expression_list)
+			{
+				if (e->expr_kind == EXPR_DECL && e->decl_expr == index) found = true;
+			}
+		}
+		if (!found) return;
+	}
+
+	RangeWalk walk = { .index = index, .check_writes = true };
+	vec_add(walk.watched, index);
+	if (collection) vec_add(walk.watched, collection);
+	range_walk_stmt(&walk, astptr(statement->for_stmt.body));
+	if (vec_size(walk.clobbered)) return;
+	range_add_proofs(&walk, collection, min_len);
+}
+
+/**
+ * A foreach over an array, vector or slice only indexes the collection using the hidden
+ * index, which is always in range as long as the collection itself isn't replaced while
+ * iterating. Arrays and vectors can't change length, and neither can a slice copied into
+ * a hidden temporary, in those cases collection is NULL and the checks can be removed
+ * immediately.
+ */
+void sema_range_analyse_foreach(SemaContext *context, Ast *statement, Decl *index, Decl *collection)
+{
+	if (!safe_mode_enabled() || context->call_env.kind != CALL_ENV_FUNCTION) return;
+	RangeWalk walk = { .index = index, .check_writes = true };
+	if (collection)
+	{
+		if (!range_is_trackable(collection)) return;
+		vec_add(walk.watched, collection);
+	}
+	range_walk_stmt(&walk, astptr(statement->for_stmt.body));
+	if (vec_size(walk.clobbered)) return;
+	FOREACH(Expr *, subscript, walk.subscripts)
+	{
+		if (!collection)
+		{
+			subscript->subscript_expr.no_check = true;
+			continue;
+		}
+		if (range_ident_var(exprptr(subscript->subscript_expr.expr)) != collection) continue;
+		vec_add(compiler.context.range_proofs, ((RangeProof) { .subscript = subscript, .collection = collection }));
+	}
+}
+
+/**
+ * Once the function body is complete, remove the checks for all loops where
+ * neither the index nor the collection has its address taken.
+ */
+void sema_range_resolve_proofs(Ast *body, unsigned first_proof)
+{
+	RangeProof *proofs = compiler.context.range_proofs;
+	unsigned count = vec_size(proofs);
+	if (count <= first_proof) return;
+	RangeWalk walk = { .check_writes = false };
+	for (unsigned i = first_proof; i < count; i++)
+	{
+		if (proofs[i].index) vec_add(walk.watched, proofs[i].index);
+		if (proofs[i].collection) vec_add(walk.watched, proofs[i].collection);
+	}
+	range_walk_stmt(&walk, body);
+	for (unsigned i = first_proof; i < count; i++)
+	{
+		RangeProof *proof = &proofs[i];
+		if (proof->index && range_decl_in_list(walk.clobbered, proof->index)) continue;
+		if (proof->collection && range_decl_in_list(walk.clobbered, proof->collection)) continue;
+		proof->subscript->subscript_expr.no_check = true;
+	}
+	vec_resize(compiler.context.range_proofs, first_proof);
+}
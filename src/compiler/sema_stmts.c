@@ -1484,6 +1484,7 @@ static inline bool sema_analyse_for_stmt(SemaContext *context, Ast *statement)
 		if (!success) context->active_scope.is_poisoned = true;
 		SET_JUMP_END(context, statement);
 	}
+	if (success) sema_range_analyse_for(context, statement);
 	return success;
 }
 
@@ -1948,8 +1949,26 @@ SKIP_OVERLOAD:;
 										.body = astid(compound_stmt),
 	};
 	statement->ast_kind = AST_FOR_STMT;
-	return sema_analyse_for_stmt(context, statement);
+	if (!sema_analyse_for_stmt(context, statement)) return false;
 
+	// Indexing with the hidden index is always in range unless a slice variable is changed in the body.
+	if (!len && !is_single_pass)
+	{
+		switch (enumerator_type->type_kind)
+		{
+			case TYPE_ARRAY:
+			case VECTORS:
+				sema_range_analyse_foreach(context, statement, idx_decl, NULL);
+				break;
+			case TYPE_SLICE:
+				if (is_addr) break;
+				sema_range_analyse_foreach(context, statement, idx_decl, enumerator->expr_kind == EXPR_IDENTIFIER ? decl_raw(temp) : NULL);
+				break;
+			default:
+				break;
+		}
+	}
+	return true;
 }
 static inline bool sema_check_for_dead_code(SemaContext *context, Ast *statement)
 {
@@ -3080,6 +3099,8 @@ bool sema_analyse_ct_echo_stmt(SemaContext *context, Ast *statement)
 	{
 		RETURN_SEMA_ERROR(message, "Expected a constant value.");
 	}
+	// Each echo should be printed, so don't let a macro containing it be folded once.
+	compiler.context.call_site_builtins_used++;
 	const char *prefix = compiler.build.echo_prefix ? compiler.build.echo_prefix : "c3c:";
 	while (prefix[0] != 0)
 	{
@@ -3410,6 +3431,7 @@ bool sema_analyse_function_body(SemaContext *context, Decl *func, unsigned macro
 		.ignore_deprecation = func->allow_deprecated || decl_is_deprecated(func)
 	};
 	context->call_env = env;
+	unsigned first_range_proof = vec_size(compiler.context.range_proofs);
 
 	Type *rtype = context->rtype = typeget(signature->rtype);
 	bool is_lambda = func->func_decl.is_lambda;
@@ -3498,6 +3520,7 @@ NEXT:
 			func->func_decl.lambda_ct_parameters[i]->var.is_read = ct_param->var.is_read;
 		}
 	}
+	sema_range_resolve_proofs(body, first_range_proof);
 	return true;
 }
 
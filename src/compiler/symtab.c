@@ -425,6 +425,7 @@ void symtab_init(uint32_t capacity)
 	attribute_list[ATTRIBUTE_SIMD] = kw_at_simd;
 	attribute_list[ATTRIBUTE_TEST] = KW_DEF("@test");
 	attribute_list[ATTRIBUTE_TAG] = KW_DEF("@tag");
+	attribute_list[ATTRIBUTE_TARGET_CLONES] = KW_DEF("@target_clones");
 	attribute_list[ATTRIBUTE_UNUSED] = KW_DEF("@unused");
 	attribute_list[ATTRIBUTE_USED] = KW_DEF("@used");
 	attribute_list[ATTRIBUTE_WASM] = KW_DEF("@wasm");
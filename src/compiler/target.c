@@ -237,6 +237,67 @@ static const char *x86_feature_name[] = {
 	[X86_FEAT_SOFT_FLOAT] = "soft-float",
 };
 
+static const X86CloneFeature x86_clone_features[] = {
+	{ "sse3", CPUID_LEAF1_ECX, 0, CPUID_OS_STATE_NONE },
+	{ "pclmul", CPUID_LEAF1_ECX, 1, CPUID_OS_STATE_NONE },
+	{ "ssse3", CPUID_LEAF1_ECX, 9, CPUID_OS_STATE_NONE },
+	{ "fma", CPUID_LEAF1_ECX, 12, CPUID_OS_STATE_AVX },
+	{ "sse4.1", CPUID_LEAF1_ECX, 19, CPUID_OS_STATE_NONE },
+	{ "sse4.2", CPUID_LEAF1_ECX, 20, CPUID_OS_STATE_NONE },
+	{ "movbe", CPUID_LEAF1_ECX, 22, CPUID_OS_STATE_NONE },
+	{ "popcnt", CPUID_LEAF1_ECX, 23, CPUID_OS_STATE_NONE },
+	{ "aes", CPUID_LEAF1_ECX, 25, CPUID_OS_STATE_NONE },
+	{ "avx", CPUID_LEAF1_ECX, 28, CPUID_OS_STATE_AVX },
+	{ "f16c", CPUID_LEAF1_ECX, 29, CPUID_OS_STATE_AVX },
+	{ "bmi", CPUID_LEAF7_EBX, 3, CPUID_OS_STATE_NONE },
+	{ "avx2", CPUID_LEAF7_EBX, 5, CPUID_OS_STATE_AVX },
+	{ "bmi2", CPUID_LEAF7_EBX, 8, CPUID_OS_STATE_NONE },
+	{ "avx512f", CPUID_LEAF7_EBX, 16, CPUID_OS_STATE_AVX512 },
+	{ "avx512dq", CPUID_LEAF7_EBX, 17, CPUID_OS_STATE_AVX512 },
+	{ "adx", CPUID_LEAF7_EBX, 19, CPUID_OS_STATE_NONE },
+	{ "avx512ifma", CPUID_LEAF7_EBX, 21, CPUID_OS_STATE_AVX512 },
+	{ "avx512cd", CPUID_LEAF7_EBX, 28, CPUID_OS_STATE_AVX512 },
+	{ "sha", CPUID_LEAF7_EBX, 29, CPUID_OS_STATE_NONE },
+	{ "avx512bw", CPUID_LEAF7_EBX, 30, CPUID_OS_STATE_AVX512 },
+	{ "avx512vl", CPUID_LEAF7_EBX, 31, CPUID_OS_STATE_AVX512 },
+	{ "avx512vbmi", CPUID_LEAF7_ECX, 1, CPUID_OS_STATE_AVX512 },
+	{ "avx512vbmi2", CPUID_LEAF7_ECX, 6, CPUID_OS_STATE_AVX512 },
+	{ "gfni", CPUID_LEAF7_ECX, 8, CPUID_OS_STATE_NONE },
+	{ "vaes", CPUID_LEAF7_ECX, 9, CPUID_OS_STATE_AVX },
+	{ "vpclmulqdq", CPUID_LEAF7_ECX, 10, CPUID_OS_STATE_AVX },
+	{ "avx512vnni", CPUID_LEAF7_ECX, 11, CPUID_OS_STATE_AVX512 },
+	{ "avx512bitalg", CPUID_LEAF7_ECX, 12, CPUID_OS_STATE_AVX512 },
+	{ "avx512vpopcntdq", CPUID_LEAF7_ECX, 14, CPUID_OS_STATE_AVX512 },
+	{ "lzcnt", CPUID_EXT1_ECX, 5, CPUID_OS_STATE_NONE },
+};
+
+const X86CloneFeature *x86_clone_feature_find(const char *name, size_t len)
+{
+	for (size_t i = 0; i < ELEMENTLEN(x86_clone_features); i++)
+	{
+		const char *feature = x86_clone_features[i].name;
+		if (strlen(feature) == len && memcmp(feature, name, len) == 0) return &x86_clone_features[i];
+	}
+	return NULL;
+}
+
+/**
+ * Clones are dispatched through an ifunc, so we need x64 ELF with a loader that resolves them.
+ */
+bool target_clones_supported(void)
+{
+	if (compiler.platform.arch != ARCH_TYPE_X86_64 || compiler.platform.object_format != OBJ_FORMAT_ELF) return false;
+	switch (compiler.platform.os)
+	{
+		case OS_TYPE_LINUX:
+			return compiler.build.linuxpaths.libc != LINUX_LIBC_MUSL;
+		case OS_TYPE_FREEBSD:
+			return true;
+		default:
+			return false;
+	}
+}
+
 int target_alloca_addr_space()
 {
 	return compiler.platform.alloca_address_space;
@@ -2008,10 +2069,14 @@ void *llvm_target_machine_create(void)
 										   compiler.platform.cpu ? compiler.platform.cpu : "", compiler.platform.features ? compiler.platform.features : "",
 										   (LLVMCodeGenOptLevel)compiler.platform.llvm_opt_level,
 										   reloc_mode, model);
+	if (!result) error_exit("Failed to create target machine.");
 	LLVMSetTargetMachineUseInitArray(result, true);
 	if (compiler.platform.emulated_tls) LLVMSetTargetMachineEmulatedTLS(result, true);
-
-	if (!result) error_exit("Failed to create target machine.");
+	if (compress_debug_enabled() && !LLVMSetTargetMachineCompressDebugSections(result, compiler.build.compress_debug == COMPRESS_DEBUG_ZSTD))
+	{
+		error_exit("Debug section compression using '%s' is not supported by this LLVM build.",
+				   compiler.build.compress_debug == COMPRESS_DEBUG_ZSTD ? "zstd" : "zlib");
+	}
 	LLVMSetTargetMachineAsmVerbosity(result, 1);
 	return result;
 }
@@ -2411,6 +2476,20 @@ void target_setup(BuildTarget *build_target)
 	}
 	ASSERT(compiler.platform.reloc_model != RELOC_DEFAULT);
 
+	if (compiler.platform.object_format != OBJ_FORMAT_ELF)
+	{
+		if (build_target->split_debug == SPLIT_DEBUG_ON)
+		{
+			WARNING("Split debug info is only supported for ELF targets, '--split-debug' will be ignored.");
+			build_target->split_debug = SPLIT_DEBUG_OFF;
+		}
+		if (build_target->compress_debug > COMPRESS_DEBUG_NONE)
+		{
+			WARNING("Debug section compression is only supported for ELF targets, '--compress-debug-sections' will be ignored.");
+			build_target->compress_debug = COMPRESS_DEBUG_NONE;
+		}
+	}
+
 		// TODO remove
 	type_setup(&compiler.platform);
 
@@ -187,7 +187,34 @@ typedef struct
 
 } PlatformTarget;
 
+typedef enum
+{
+	CPUID_LEAF1_ECX,
+	CPUID_LEAF7_EBX,
+	CPUID_LEAF7_ECX,
+	CPUID_EXT1_ECX,
+	CPUID_WORD_COUNT
+} CpuidWord;
+
+typedef enum
+{
+	CPUID_OS_STATE_NONE,
+	CPUID_OS_STATE_AVX,
+	CPUID_OS_STATE_AVX512,
+} CpuidOsState;
+
+// Where a @target_clones feature is found in the cpuid output.
+typedef struct
+{
+	const char *name;
+	CpuidWord word;
+	unsigned char bit;
+	CpuidOsState os_state;
+} X86CloneFeature;
+
 ArchType target_host_arch(void);
+const X86CloneFeature *x86_clone_feature_find(const char *name, size_t len);
+bool target_clones_supported(void);
 
 static inline bool is_pie_pic(RelocModel reloc)
 {
@@ -67,6 +67,7 @@ typedef struct
 } LLVMPasses;
 
 bool llvm_run_passes(LLVMModuleRef m, LLVMTargetMachineRef tm, LLVMPasses *passes);
+unsigned llvm_split_module(LLVMModuleRef m, unsigned parts, LLVMMemoryBufferRef *buffers);
 bool llvm_link_elf(const char **args, int arg_count, const char **error_string);
 bool llvm_link_macho(const char **args, int arg_count, const char **error_string);
 bool llvm_link_coff(const char **args, int arg_count, const char **error_string);
@@ -81,6 +82,8 @@ void LLVMBuilderSetFastMathFlags(LLVMBuilderRef Builder, FastMathOption option);
 void LLVMSetDSOLocal(LLVMValueRef Global, bool value);
 void LLVMSetTargetMachineUseInitArray(LLVMTargetMachineRef ref, bool use_init_array);
 void LLVMSetTargetMachineEmulatedTLS(LLVMTargetMachineRef ref, bool emulated_tls);
+bool LLVMSetTargetMachineCompressDebugSections(LLVMTargetMachineRef ref, bool use_zstd);
+bool llvm_emit_split_dwarf_object(LLVMTargetMachineRef ref, LLVMModuleRef module, const char *dwo_filename, LLVMMemoryBufferRef *obj_buffer, LLVMMemoryBufferRef *dwo_buffer, char **error);
 void LLVMSetNoSanitizeAddress(LLVMValueRef Global);
 unsigned LLVMGetFunctionInstructionCount(LLVMValueRef function);
 
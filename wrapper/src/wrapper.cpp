@@ -31,6 +31,11 @@
 #include "llvm/Transforms/Scalar/JumpThreading.h"
 #include "llvm/Transforms/InstCombine/InstCombine.h"
 #include "llvm/Analysis/GlobalsModRef.h"
+#include "llvm/Bitcode/BitcodeWriter.h"
+#include "llvm/Transforms/Utils/SplitModule.h"
+#include "llvm/IR/LegacyPassManager.h"
+#include "llvm/Support/Compression.h"
+#include "llvm/MC/MCAsmInfo.h"
 static_assert(LLVM_VERSION_MAJOR >= 19, "Unsupported LLVM version, 19+ is needed.");
 
 #define LINK_SIG \
@@ -275,6 +280,34 @@ bool llvm_run_passes(LLVMModuleRef m, LLVMTargetMachineRef tm, LLVMPasses *passe
 	return true;
 }
 
+static bool llvm_module_has_definitions(const llvm::Module &module)
+{
+	for (const llvm::Function &function : module.functions())
+	{
+		if (!function.isDeclaration()) return true;
+	}
+	for (const llvm::GlobalVariable &global : module.globals())
+	{
+		if (!global.isDeclaration()) return true;
+	}
+	return false;
+}
+
+unsigned llvm_split_module(LLVMModuleRef m, unsigned parts, LLVMMemoryBufferRef *buffers)
+{
+	llvm::Module *Mod = llvm::unwrap(m);
+	unsigned count = 0;
+	// Keep local symbols and their users together so that nothing needs to be externalized.
+	llvm::SplitModule(*Mod, parts, [&](std::unique_ptr<llvm::Module> part) {
+		if (!llvm_module_has_definitions(*part)) return;
+		llvm::SmallString<0> bitcode;
+		llvm::raw_svector_ostream stream(bitcode);
+		llvm::WriteBitcodeToFile(*part, stream);
+		buffers[count++] = LLVMCreateMemoryBufferWithMemoryRangeCopy(bitcode.data(), bitcode.size(), part->getModuleIdentifier().c_str());
+	}, true);
+	return count;
+}
+
 bool llvm_ar(const char *out_name, const char **args, size_t count, int ArFormat)
 {
 	llvm::object::Archive::Kind kind;
@@ -334,6 +367,39 @@ void LLVMSetTargetMachineEmulatedTLS(LLVMTargetMachineRef ref, bool emulated_tls
 	auto machine = (llvm::TargetMachine*)ref;
 	machine->Options.EmulatedTLS = emulated_tls;
 }
+bool LLVMSetTargetMachineCompressDebugSections(LLVMTargetMachineRef ref, bool use_zstd)
+{
+	auto machine = (llvm::TargetMachine*)ref;
+	auto type = use_zstd ? llvm::DebugCompressionType::Zstd : llvm::DebugCompressionType::Zlib;
+	if (llvm::compression::getReasonIfUnsupported(llvm::compression::formatFor(type))) return false;
+	machine->Options.CompressDebugSections = type;
+	// The MCAsmInfo copied the option when the machine was created, and the object writer reads it from there.
+	const_cast<llvm::MCAsmInfo *>(machine->getMCAsmInfo())->setCompressDebugSections(type);
+	return true;
+}
+
+bool llvm_emit_split_dwarf_object(LLVMTargetMachineRef ref, LLVMModuleRef module, const char *dwo_filename, LLVMMemoryBufferRef *obj_buffer, LLVMMemoryBufferRef *dwo_buffer, char **error)
+{
+	auto machine = (llvm::TargetMachine*)ref;
+	llvm::Module *mod = llvm::unwrap(module);
+	// The skeleton unit in the object refers to the .dwo by this name.
+	machine->Options.MCOptions.SplitDwarfFile = dwo_filename;
+	llvm::SmallVector<char, 0> obj_data;
+	llvm::SmallVector<char, 0> dwo_data;
+	llvm::raw_svector_ostream obj_stream(obj_data);
+	llvm::raw_svector_ostream dwo_stream(dwo_data);
+	llvm::legacy::PassManager pass;
+	if (machine->addPassesToEmitFile(pass, obj_stream, &dwo_stream, llvm::CodeGenFileType::ObjectFile))
+	{
+		*error = strdup("TargetMachine can't emit a split dwarf object file");
+		return false;
+	}
+	pass.run(*mod);
+	*obj_buffer = LLVMCreateMemoryBufferWithMemoryRangeCopy(obj_data.data(), obj_data.size(), "");
+	*dwo_buffer = LLVMCreateMemoryBufferWithMemoryRangeCopy(dwo_data.data(), dwo_data.size(), "");
+	return true;
+}
+
 void LLVMSetDSOLocal(LLVMValueRef Global, bool value)
 {
 	llvm::unwrap<llvm::GlobalValue>(Global)->setDSOLocal(value);